@@ -98,6 +98,26 @@
 #define sl_B_PERLINE       (0x0004)
 #define sl_B_PERCHAR       (0x0005)
 
+/* Record parsing flags */
+#define sl_R_IS(t, x)      sl_ISFLAG((t), (x) & sl_R_MASK)
+#define sl_R_MASK          (0x00FF)
+#define sl_R_QUOTED        (0x0001) /**< Fields may be enclosed by the format's quote character. */
+#define sl_R_DQUOTE        (0x0002) /**< A doubled quote character inside a quoted field stands for a literal quote (RFC 4180 style). */
+#define sl_R_ESCAPED       (0x0004) /**< The format's escape character makes the following character literal. */
+#define sl_R_CRLF          (0x0008) /**< A carriage return immediately preceding the record terminator is not part of the last field. */
+#define sl_R_SKIPEMPTY     (0x0010) /**< Empty records (two consecutive terminators) are skipped. */
+#define sl_R_KEYVAL        (0x0020) /**< Each field is further split on the first unquoted, unescaped occurrence of the format's @c keysep character (e.g. key=value logs). Key and value are quoted and escaped independently of each other. */
+#define sl_R_NOSIMD        (0x0040) /**< Disables vectorized structural scanning, forcing the walker-based path. Mostly for debugging. */
+
+/* Field view flags */
+#define sl_F_IS(t, x)      sl_ISFLAG((t), (x) & sl_F_MASK)
+#define sl_F_MASK          (0x001F)
+#define sl_F_QUOTED        (0x0001) /**< The value was enclosed in quotes. The view excludes the enclosing quotes. */
+#define sl_F_RAW           (0x0002) /**< The value view still contains escape sequences or doubled quotes, and must be passed through @c sl_recunescape to get the literal value. */
+#define sl_F_HASKEY        (0x0004) /**< The field had an unquoted, unescaped key separator; @c keypos and @c keylen are valid. */
+#define sl_F_KEYQUOTED     (0x0008) /**< The key was enclosed in quotes. The view excludes the enclosing quotes. */
+#define sl_F_KEYRAW        (0x0010) /**< The key view still contains escape sequences or doubled quotes, and must be passed through @c sl_recunescapekey to get the literal value. */
+
 /* Char types */
 #define sl_C_MASK          (0x1fff) /**< The valid range of ctype flags. */
 #define sl_C_SPACE         (0x0080) /**< A space character, including newlines and tabs. */
@@ -162,6 +182,8 @@ typedef struct slhnd_t    slhnd_t;    /**< A handle that (semi-)opaquely represe
 typedef struct slopts_t   slopts_t;   /**< Simple POD structure used to pass standardized options on handle creation. */
 typedef struct slenc_t    slenc_t;    /**< Represents and implements an encoding (e.g. codepage, etc). */
 typedef struct slhandle_a slhandle_a; /**< An API capable of generating handles. */
+typedef struct slrecfmt_t slrecfmt_t; /**< Simple POD structure describing the structural characters of a delimited record format (e.g. CSV, TSV). */
+typedef struct slfield_t  slfield_t;  /**< A non-owning view of a single field inside a record parser's buffer. */
 
 /* Delegates and signatures */
 typedef slecode_e (*slevent_f)  (void* eventp, int what, slhnd_t* who, const char* where, void* ctx); /* Return: <0 - partially recovered, but should continue; =0 - fully recovered, must continue; >0 - not recovered, must abort */
@@ -217,6 +239,7 @@ enum slhtype_e {
 	sl_T_BUFFER,      /* b */ /**< handle works as a stream buffer, either standalone or proxied. */
 	sl_T_FILE,        /* f */ /**< handle works as a file. */
 	sl_T_STRING,      /* s */ /**< handle works as an in-memory string, dynamic or not. */
+	sl_T_RECPARSER,   /* r */ /**< handle is a delimited-record parser over a readable stream. */
 		
 	/* Natures (in reality, just a cute term for Java-like interfaces) */
 	sl_T_READABLE,    /* _ */ /**< handle is a readable stream. */
@@ -282,6 +305,26 @@ struct slopts_t {
 };
 
 
+struct slrecfmt_t {
+	slcpoint_t      delim;   /**< Field delimiter (e.g. @c ',' or @c '\t'). Mandatory. */
+	slcpoint_t      term;    /**< Record terminator. Defaults to @c '\n' if 0. */
+	slcpoint_t      quote;   /**< Quote character, used only if @c sl_R_QUOTED is set. */
+	slcpoint_t      escape;  /**< Escape character, used only if @c sl_R_ESCAPED is set. */
+	slcpoint_t      keysep;  /**< Key-value separator, used only if @c sl_R_KEYVAL is set. */
+	slflags_t       flags;   /**< Combination of @c sl_R_* flags. */
+	size_t          nfieldshint; /**< Expected number of fields per record, used only to presize the parser's field array. 0 means the implementation's default. Records with more fields are not an error: @c sl_recnext grows the array as needed. */
+};
+
+
+struct slfield_t {
+	const char*     pos;     /**< Start of the field's value, pointing into the parser's buffer. Never null-terminated. If @c sl_F_HASKEY is set, this is the part after the key separator; otherwise, it is the whole field. */
+	size_t          len;     /**< Byte length of the value. */
+	const char*     keypos;  /**< If @c sl_F_HASKEY is set, start of the key part (before the key separator); otherwise, NULL. */
+	size_t          keylen;  /**< If @c sl_F_HASKEY is set, byte length of the key part; otherwise, 0. */
+	slflags_t       flags;   /**< Combination of @c sl_F_* flags. @c sl_F_QUOTED and @c sl_F_RAW describe the value view; @c sl_F_KEYQUOTED and @c sl_F_KEYRAW describe the key view. */
+};
+
+
 /*
  * [ [ [ GLOBAL METHODS ] ] ] ==================================================
  *
@@ -446,6 +489,44 @@ sl_API slecode_e      sl_cinit     (slhnd_t* cnv); /**< Initializes the walker o
 sl_API slecode_e      sl_cisinit   (slhnd_t* cnv); /**< Checks if the walker or converter is in its initial state. */
 
 
+/*
+ * [ [ [ RECORD PARSER METHODS ] ] ] ===========================================
+ *
+ * A record parser splits a readable stream into delimited records (e.g. CSV,
+ * TSV, key=value logs) without re-reading a format string for every record
+ * and without copying fields, as @c sl_scanf and @c sl_gets would. The format
+ * is given once through a @c slrecfmt_t, and each record is returned as an
+ * array of @c slfield_t views into the parser's buffer.
+ *
+ * Some considerations about record parsers:
+ * + Field views are only valid until the next call to @c sl_recnext (or until
+ *   the parser is closed), as the buffer may be refilled or moved. Copy the
+ *   bytes out if they must outlive the record.
+ * + Views are raw: quoted fields exclude their enclosing quotes, but escape
+ *   sequences and doubled quotes are left in place and flagged with
+ *   @c sl_F_RAW. Use @c sl_recunescape to obtain the literal value.
+ * + With @c sl_R_KEYVAL, the key and the value get separate views, neither
+ *   of which includes the (possibly multi-byte) key separator. Fields without
+ *   a key separator are returned whole as the value, without @c sl_F_HASKEY.
+ * + The stream's encoding is honored. For ASCII-compatible encodings (see
+ *   @c slenc_t's @c asciicompat) with ASCII structural characters,
+ *   implementations are expected to locate delimiters, quotes, escapes and
+ *   terminators by scanning whole blocks into bitmasks (SIMD where available),
+ *   as no structural byte can then appear inside a multi-byte sequence. Any
+ *   other encoding, or non-ASCII structural characters, fall back to walking
+ *   the buffer codepoint by codepoint through the encoding's walker.
+ * + A record whose quoted field spans a buffer refill is handled by the
+ *   parser; the user always receives complete records.
+ */
+
+
+sl_API slhnd_t*       sl_recparse    (slhnd_t* hnd, const slrecfmt_t* fmt, const slopts_t* opts); /**< Creates a record parser reading from @c hnd, using the format @c fmt (mandatory, copied by the parser). The parser does not own @c hnd unless @c opts->autoquit is @c sl_yes. */
+sl_API slecode_e      sl_recnext     (slhnd_t* parser, const slfield_t** fields, size_t* nfields); /**< Parses the next record. On @c sl_E_OK, @c *fields points to @c *nfields views. Returns @c sl_E_END when no more records are available. */
+sl_API size_t         sl_recnum      (slhnd_t* parser); /**< Returns the number of records parsed so far (i.e. the 1-based number of the current record). */
+sl_API ssize_t        sl_recunescape (slhnd_t* parser, const slfield_t* field, char* buf, size_t bytesz); /**< Copies the literal value of @c field into @c buf, resolving escapes and doubled quotes. Returns the number of bytes written, or a negative value if @c buf is too small. */
+sl_API ssize_t        sl_recunescapekey (slhnd_t* parser, const slfield_t* field, char* buf, size_t bytesz); /**< Same as @c sl_recunescape, but for the key view of a field having @c sl_F_HASKEY. */
+
+
 /*
  * [ [ [ EVENT FUNCTIONS ] ] ] =================================================
  * 
@@ -31,6 +31,7 @@ typedef struct slfilter_a   slfilter_a; /**< API definition for a stream filter
 typedef struct slbuffer_a   slbuffer_a; /**< API definition for a stream buffer instance. */
 typedef struct slfile_a     slfile_a;   /**< API definition for a file stream instance. */
 typedef struct slstring_a   slstring_a; /**< API definition for a string stream instance. */
+typedef struct slrecparser_a slrecparser_a; /**< API definition for a record parser instance. */
 
 /* Delegates and signatures */
 typedef void*             (*slgetapi_f) (slhnd_t* hnd, int htype);
@@ -62,6 +63,7 @@ struct slenc_t {
 	size_t            maxelems;   /**< The maximum number of elements used to represent a single character point in the encoding. */
 	size_t            maxchars;   /**< The maximum number of character points used to represent a single character in the encoding. This is provided for compatibility with encodings that support character point composition, such as Unicode. Clients can then allocate buffers big enough to allocate any possible character in the encoding. */
 	const slcpoint_t* eos;        /**< */
+	sltbool           asciicompat; /**< @c sl_yes if every ASCII character is represented by its single ASCII byte, and no such byte appears inside any other character's representation (e.g. ASCII, ISO-8859-*, UTF-8). Allows byte-oriented fast paths, such as the record parser's bitmask scanning. */
 	
 	size_t          (*listderiv) (int (*visitor)(void* state, const slenc_t* enc), void* visitorp);
 	size_t          (*listalias) (int (*visitor)(void* state, const char* alias), void* visitorp);
@@ -101,6 +103,47 @@ struct slcconv_t {
 };
 
 
+struct slrecmasks_t {
+	unsigned long* delim;  /**< Bits for @c fmt.delim. */
+	unsigned long* quote;  /**< Bits for @c fmt.quote, or NULL if @c sl_R_QUOTED is not set. */
+	unsigned long* escape; /**< Bits for @c fmt.escape, or NULL if @c sl_R_ESCAPED is not set. */
+	unsigned long* term;   /**< Bits for @c fmt.term. */
+	unsigned long* keysep; /**< Bits for @c fmt.keysep, or NULL if @c sl_R_KEYVAL is not set. */
+};
+
+
+struct slrecparser_t {
+	slhnd_t*          stream;     /**< Readable stream being parsed. */
+	const slenc_t*    enc;        /**< Encoding of @c stream, captured at creation time. */
+	slrecfmt_t        fmt;        /**< Copy of the record format. */
+	char*             buf;        /**< Buffer that field views point into. */
+	size_t            bufsz;
+	const char*       pos;        /**< Start of the next unparsed record in @c buf. */
+	const char*       end;        /**< End of the valid bytes in @c buf. */
+	slfield_t*        fields;     /**< Field views of the current record. */
+	size_t            nfields;
+	size_t            fieldcap;
+	size_t            recnum;
+	slbool            fastpath;   /**< @c sl_true only if @c enc->asciicompat is @c sl_yes, every structural codepoint enabled in @c fmt is below 0x80, and @c sl_R_NOSIMD is not set. When false, @c scan is never called and the encoding's walker is used instead. */
+	
+	/**
+	 * Scans @c blk for structural bytes. Bit `i % W` of word `i / W` of each
+	 * array in @c masks is set iff `blk[i]` equals that class' character,
+	 * where `W = CHAR_BIT * sizeof(unsigned long)`. Each non-NULL array must
+	 * hold at least `(blksz + W - 1) / W` words; @c blksz need not be a
+	 * multiple of @c W, and bits past @c blksz in the last word are zeroed.
+	 * Returns the number of bytes scanned. A short scan is allowed (e.g. to
+	 * stop at a vector-width boundary) but must be a multiple of @c W; the
+	 * caller then resumes at `blk + returned`, and bits past the returned
+	 * count are unspecified. Implementations may use SIMD compares and
+	 * movemask. Only called when @c fastpath is true.
+	 */
+	size_t    (*scan)    (struct slrecparser_t* rp, const char* blk, size_t blksz, struct slrecmasks_t* masks);
+	slecode_e (*refill)  (struct slrecparser_t* rp); /**< Moves the unparsed tail to the start of @c buf and reads more data from @c stream, growing @c buf if a single record does not fit. */
+	slecode_e (*dispose) (struct slrecparser_t* rp);
+};
+
+
 /*
  * [ [ [ API STRUCTURES AND UNIONS ] ] ] =======================================
  */